@@ -24,7 +24,7 @@
 
 // for std::is_same, std::is_arithmetic, std::conjunction, 
 // std::is_standard_layout, std::is_class, std::is_enum, 
-// std::is_bounded_array, std::invoke_result, std::is_integral, 
+// std::is_bounded_array, std::remove_extent, std::is_integral, 
 // std::is_floating_point, std::is_trivially_copyable,
 // std::disjunction, std::remove_cvref 
 #include <type_traits> 
@@ -34,11 +34,13 @@
 #include <cstdint>
 // for std::memcpy
 #include <cstring>
-// for std::max, std::reverse
+// for std::max, std::reverse, std::all_of
 #include <algorithm>
 #include <array>
 // for std::tuple, std::tuple_element
 #include <tuple>
+// for std::index_sequence, std::make_index_sequence
+#include <utility>
 // for std::endian, std::bit_cast
 # include <bit>
 
@@ -63,6 +65,12 @@
 # define __EVI_CONSTINIT constexpr
 #endif
 
+// -------------------------------------------------------------------------
+// Maximum amount of fields in a struct, can be defined before including.
+#ifndef EVI_MAX_STRUCT_FIELDS
+# define EVI_MAX_STRUCT_FIELDS 256
+#endif
+
 namespace evi {
 // -------------------------------------------------------------------------
 // Forward declaration
@@ -157,6 +165,21 @@ struct is_bounded_array<std::array<T, Len>>
 template<typename T>
 constexpr bool is_bounded_array_v = is_bounded_array<T>::value;
 
+// -------------------------------------------------------------------------
+// Getting the element type of std::array<T, N> or array[N]
+template<typename T>
+struct array_value_type {
+	using type = std::remove_extent_t<T>;
+};
+
+template<typename T, size_t Len>
+struct array_value_type<std::array<T, Len>> {
+	using type = T;
+};
+
+template<typename T>
+using array_value_type_t = typename array_value_type<T>::type;
+
 // -------------------------------------------------------------------------
 // Checks if a type is a plain type, meaning a type is not const, volatile, 
 // reference or pointer.
@@ -348,79 +371,84 @@ struct UniversalType
 	operator T() const;
 };
 
+// -------------------------------------------------------------------------
+// Checks if a POD can be aggregate initialized with N members.
+template<typename T, size_t... Is>
+__EVI_CONSTEVAL bool is_initializable_with(std::index_sequence<Is...>)
+{
+	return requires { T{ (static_cast<void>(Is), UniversalType{})... }; };
+}
+
+template<typename T, size_t N>
+constexpr bool is_initializable_with_v = is_initializable_with<T>(std::make_index_sequence<N>{});
+
 // -------------------------------------------------------------------------
 // Counting the amount of members in a POD.
+// Binary searching between Low and High, so only log2(High)
+// aggregate initializations are instantiated instead of one per field.
 // NOTE: This only works for aggregate types.
-template<typename T, typename... Ts>
-__EVI_CONSTEVAL auto count_member_fields(Ts... members)
+template<typename T, size_t Low, size_t High>
+__EVI_CONSTEVAL size_t count_member_fields_between()
 {
-	if constexpr( requires { T{members...}; } == false )
-		return sizeof...(members) - 1;
+	if constexpr(Low == High)
+		return Low;
 	else
-		return count_member_fields<T>(members..., UniversalType{});
-} 
+	{
+		constexpr size_t mid = (Low + High + 1) / 2;
 
-// -------------------------------------------------------------------------
-// Template specialization up to 32 fields in a struct.
-template<size_t size, typename T>
-struct StructToTuple;
-
-#define __EVI_MAKE_STRUCT_TO_TUPLE_SPECIALIZATION(STRUCT, FIELDS_NUM, ...) \
-	template<typename T>                                                   \
-	struct STRUCT<FIELDS_NUM, T> {                                         \
-		static constexpr auto unevaluated(T& u) noexcept          		   \
-		{                                                          		   \
-			auto&& [__VA_ARGS__] = u;                          			   \
-			return std::tuple{__VA_ARGS__};                    			   \
-		}                                                          		   \
+		if constexpr(is_initializable_with_v<T, mid>)
+			return count_member_fields_between<T, mid, High>();
+		else
+			return count_member_fields_between<T, Low, mid - 1>();
 	}
+}
 
-// Yeah, Nasty...
-// Only if we had variadic structured bindings... :)
-__EVI_MAKE_STRUCT_TO_TUPLE_SPECIALIZATION(StructToTuple, 1 , m1);
-__EVI_MAKE_STRUCT_TO_TUPLE_SPECIALIZATION(StructToTuple, 2 , m1, m2);
-__EVI_MAKE_STRUCT_TO_TUPLE_SPECIALIZATION(StructToTuple, 3 , m1, m2, m3);
-__EVI_MAKE_STRUCT_TO_TUPLE_SPECIALIZATION(StructToTuple, 4 , m1, m2, m3, m4);
-__EVI_MAKE_STRUCT_TO_TUPLE_SPECIALIZATION(StructToTuple, 5 , m1, m2, m3, m4, m5);
-__EVI_MAKE_STRUCT_TO_TUPLE_SPECIALIZATION(StructToTuple, 6 , m1, m2, m3, m4, m5, m6);
-__EVI_MAKE_STRUCT_TO_TUPLE_SPECIALIZATION(StructToTuple, 7 , m1, m2, m3, m4, m5, m6, m7);
-__EVI_MAKE_STRUCT_TO_TUPLE_SPECIALIZATION(StructToTuple, 8 , m1, m2, m3, m4, m5, m6, m7, m8);
-__EVI_MAKE_STRUCT_TO_TUPLE_SPECIALIZATION(StructToTuple, 9 , m1, m2, m3, m4, m5, m6, m7, m8, m9);
-__EVI_MAKE_STRUCT_TO_TUPLE_SPECIALIZATION(StructToTuple, 10, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10);
-__EVI_MAKE_STRUCT_TO_TUPLE_SPECIALIZATION(StructToTuple, 11, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11);
-__EVI_MAKE_STRUCT_TO_TUPLE_SPECIALIZATION(StructToTuple, 12, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12);
-__EVI_MAKE_STRUCT_TO_TUPLE_SPECIALIZATION(StructToTuple, 13, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13);
-__EVI_MAKE_STRUCT_TO_TUPLE_SPECIALIZATION(StructToTuple, 14, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14);
-__EVI_MAKE_STRUCT_TO_TUPLE_SPECIALIZATION(StructToTuple, 15, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15);
-__EVI_MAKE_STRUCT_TO_TUPLE_SPECIALIZATION(StructToTuple, 16, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16);
-__EVI_MAKE_STRUCT_TO_TUPLE_SPECIALIZATION(StructToTuple, 17, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17);
-__EVI_MAKE_STRUCT_TO_TUPLE_SPECIALIZATION(StructToTuple, 18, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18);
-__EVI_MAKE_STRUCT_TO_TUPLE_SPECIALIZATION(StructToTuple, 19, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19);
-__EVI_MAKE_STRUCT_TO_TUPLE_SPECIALIZATION(StructToTuple, 20, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20);
-__EVI_MAKE_STRUCT_TO_TUPLE_SPECIALIZATION(StructToTuple, 21, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21);
-__EVI_MAKE_STRUCT_TO_TUPLE_SPECIALIZATION(StructToTuple, 22, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22);
-__EVI_MAKE_STRUCT_TO_TUPLE_SPECIALIZATION(StructToTuple, 23, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23);
-__EVI_MAKE_STRUCT_TO_TUPLE_SPECIALIZATION(StructToTuple, 24, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24);
-__EVI_MAKE_STRUCT_TO_TUPLE_SPECIALIZATION(StructToTuple, 25, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25);
-__EVI_MAKE_STRUCT_TO_TUPLE_SPECIALIZATION(StructToTuple, 26, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26);
-__EVI_MAKE_STRUCT_TO_TUPLE_SPECIALIZATION(StructToTuple, 27, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27);
-__EVI_MAKE_STRUCT_TO_TUPLE_SPECIALIZATION(StructToTuple, 28, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28);
-__EVI_MAKE_STRUCT_TO_TUPLE_SPECIALIZATION(StructToTuple, 29, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29);
-__EVI_MAKE_STRUCT_TO_TUPLE_SPECIALIZATION(StructToTuple, 30, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30);
-__EVI_MAKE_STRUCT_TO_TUPLE_SPECIALIZATION(StructToTuple, 31, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31);
-__EVI_MAKE_STRUCT_TO_TUPLE_SPECIALIZATION(StructToTuple, 32, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32);
+// Returns EVI_MAX_STRUCT_FIELDS + 1 if there are too many fields.
+template<typename T>
+__EVI_CONSTEVAL size_t count_member_fields() {
+	return count_member_fields_between<T, 0, EVI_MAX_STRUCT_FIELDS + 1>();
+}
 
 // -------------------------------------------------------------------------
-// Converting a struct into a tuple.
+// Unique address for every type, comparable at compile-time.
 template<typename T>
-using struct_to_tuple_t = std::invoke_result_t<
-	decltype(StructToTuple<count_member_fields<T>(), T>::unevaluated), T&>;
+constexpr void type_tag() noexcept {}
+
+using type_tag_t = void(*)() noexcept;
+
+struct FieldInfo
+{
+	type_tag_t tag      = nullptr;
+	bool       possible = false;
+};
+
+// Class is convertible to anything, and writes the type it was
+// converted to into a FieldInfo.
+struct FieldTypeRecorder
+{
+	FieldInfo* info;
+
+	template<typename T>
+	constexpr operator T() const
+	{
+		*info = FieldInfo{ &type_tag<T>, is_possible_type_in_struct_v<T> };
+		return T{};
+	}
+};
 
 // -------------------------------------------------------------------------
-// Checking all of the members in a tuple to validate them.
-template<typename T, typename... Ts>
-__EVI_CONSTEVAL bool check_tuple_types(const std::tuple<T, Ts...>*) { 
-	return std::conjunction_v<is_possible_type_in_struct<Ts>...> && std::conjunction_v<std::is_same<T, Ts>...>;	
+// Checking all of the members in a struct to validate them.
+// Instead of converting the struct into a tuple, every member is
+// recorded into an array while the struct is constructed at compile-time.
+template<typename T, size_t... Is>
+__EVI_CONSTEVAL bool check_member_types(std::index_sequence<Is...>)
+{
+	std::array<FieldInfo, sizeof...(Is)> fields{};
+	[[maybe_unused]] T object{ FieldTypeRecorder{ &fields[Is] }... };
+
+	return std::all_of(fields.begin(), fields.end(), [&fields](const FieldInfo& field) {
+		return field.possible && field.tag == fields.front().tag;
+	});
 }
 
 // -------------------------------------------------------------------------
@@ -428,10 +456,25 @@ __EVI_CONSTEVAL bool check_tuple_types(const std::tuple<T, Ts...>*) {
 template<typename T>
 __EVI_CONSTEVAL bool validate_possible_structs()
 {
-	if constexpr(std::is_class_v<T>)
+	if constexpr(is_bounded_array_v<T>)
 	{
-		using tup = struct_to_tuple_t<T>;
-		return check_tuple_types(static_cast<tup*>(nullptr));
+		// Arrays are validated by their element type, without decomposing them.
+		using value_t = array_value_type_t<T>;
+
+		if constexpr(is_bounded_array_v<value_t>)
+			return validate_possible_structs<value_t>();
+		else
+			return is_possible_type_in_struct_v<value_t>;
+	}
+	else if constexpr(std::is_class_v<T>)
+	{
+		constexpr size_t fields = count_member_fields<T>();
+		static_assert(fields <= EVI_MAX_STRUCT_FIELDS, "Your struct has too many fields, define EVI_MAX_STRUCT_FIELDS.");
+
+		if constexpr(fields == 0)
+			return false;
+		else
+			return check_member_types<T>(std::make_index_sequence<fields>{});
 	}
 
 	return true;
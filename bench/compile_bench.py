@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+# Compile-time benchmark of the reflection system in SafeEndianUnion.hpp.
+#
+# For every field count, two translation units are generated:
+# - "structs": only the N-field structs, to measure parsing them.
+# - "unions":  the same structs, each one instantiated in a SafeEndianUnion.
+# The difference between them is the cost of the reflection itself.
+#
+# Time and peak memory (max RSS) of the compiler are measured with -fsyntax-only.
+# Use --include-dir to run it against another copy of the header.
+
+import argparse
+import os
+import pathlib
+import subprocess
+import sys
+import tempfile
+import time
+
+HEADER_DIR = pathlib.Path(__file__).resolve().parent.parent
+
+
+def generate(path, fields, structs, with_unions):
+    lines = ['#include "SafeEndianUnion.hpp"']
+
+    for i in range(structs):
+        members = ", ".join(f"m{j}" for j in range(fields))
+        lines.append(f"struct S{i} {{ std::uint16_t {members}; }};")
+
+        if with_unions:
+            lines.append(f"evi::SafeEndianUnion<evi::ByteOrder::Big, "
+                         f"evi::Union<std::array<std::uint16_t, {fields}>, S{i}>> u{i};")
+        else:
+            lines.append(f"static_assert(sizeof(S{i}) == {2 * fields});")
+
+    path.write_text("\n".join(lines) + "\n")
+
+
+def measure(compiler, source, repeat, max_fields, include_dir):
+    command = [compiler, "-std=c++20", "-fsyntax-only",
+               f"-DEVI_MAX_STRUCT_FIELDS={max_fields}",
+               f"-I{include_dir}", str(source)]
+    seconds, max_rss_kb = [], []
+
+    for _ in range(repeat):
+        start = time.perf_counter()
+        process = subprocess.Popen(command)
+        _, status, usage = os.wait4(process.pid, 0)
+        seconds.append(time.perf_counter() - start)
+
+        if os.waitstatus_to_exitcode(status) != 0:
+            sys.exit(f"compilation failed: {' '.join(command)}")
+
+        # ru_maxrss is in kilobytes on Linux and in bytes on macOS.
+        rss = usage.ru_maxrss // 1024 if sys.platform == "darwin" else usage.ru_maxrss
+        max_rss_kb.append(rss)
+
+    return min(seconds), min(max_rss_kb) / 1024
+
+
+parser = argparse.ArgumentParser(description="Compile-time benchmark of SafeEndianUnion reflection.")
+parser.add_argument("--compiler", default=os.environ.get("CXX", "c++"))
+parser.add_argument("--fields", type=int, nargs="+", default=[8, 32, 64, 128, 256])
+parser.add_argument("--structs", type=int, default=20, help="structs per translation unit")
+parser.add_argument("--repeat", type=int, default=3, help="best of N compilations")
+parser.add_argument("--max-fields", type=int, default=256, help="EVI_MAX_STRUCT_FIELDS")
+parser.add_argument("--include-dir", default=str(HEADER_DIR), help="directory of SafeEndianUnion.hpp")
+args = parser.parse_args()
+
+print(f"{args.compiler}, {args.structs} structs per TU, best of {args.repeat}")
+print(f"{'fields':>6} | {'structs s':>9} {'MB':>6} | {'unions s':>9} {'MB':>6} "
+      f"| {'reflection s':>12} {'MB':>6} | {'ms/union':>8} {'us/field':>8} {'KB/field':>8}")
+
+with tempfile.TemporaryDirectory() as directory:
+    for fields in args.fields:
+        structs_source = pathlib.Path(directory, f"structs_{fields}.cpp")
+        unions_source  = pathlib.Path(directory, f"unions_{fields}.cpp")
+        generate(structs_source, fields, args.structs, with_unions=False)
+        generate(unions_source,  fields, args.structs, with_unions=True)
+
+        structs_time, structs_mem = measure(args.compiler, structs_source, args.repeat, args.max_fields, args.include_dir)
+        unions_time,  unions_mem  = measure(args.compiler, unions_source,  args.repeat, args.max_fields, args.include_dir)
+        reflection_time = unions_time - structs_time
+
+        print(f"{fields:>6} | {structs_time:>9.2f} {structs_mem:>6.1f} "
+              f"| {unions_time:>9.2f} {unions_mem:>6.1f} "
+              f"| {reflection_time:>12.2f} {unions_mem - structs_mem:>6.1f} "
+              f"| {1000 * reflection_time / args.structs:>8.1f} "
+              f"{1e6 * reflection_time / (args.structs * fields):>8.1f} "
+              f"{1024 * (unions_mem - structs_mem) / (args.structs * fields):>8.1f}")
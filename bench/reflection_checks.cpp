@@ -0,0 +1,72 @@
+// Compile-only checks for the reflection system in SafeEndianUnion.hpp.
+// Building this file is the test, every check is a static_assert.
+
+#include "SafeEndianUnion.hpp"
+
+// -------------------------------------------------------------------------
+// Declaring many fields without writing them by hand.
+#define __EVI_FIELDS_1(P)   std::uint32_t P;
+#define __EVI_FIELDS_8(P)   std::uint32_t P##0, P##1, P##2, P##3, P##4, P##5, P##6, P##7;
+#define __EVI_FIELDS_32(P)  __EVI_FIELDS_8(P##a)  __EVI_FIELDS_8(P##b)  __EVI_FIELDS_8(P##c)  __EVI_FIELDS_8(P##d)
+#define __EVI_FIELDS_256(P) __EVI_FIELDS_32(P##a) __EVI_FIELDS_32(P##b) __EVI_FIELDS_32(P##c) __EVI_FIELDS_32(P##d) \
+                            __EVI_FIELDS_32(P##e) __EVI_FIELDS_32(P##f) __EVI_FIELDS_32(P##g) __EVI_FIELDS_32(P##h)
+
+struct Fields1   { __EVI_FIELDS_1(m) };
+struct Fields32  { __EVI_FIELDS_32(m) };
+struct Fields33  { __EVI_FIELDS_32(m) __EVI_FIELDS_1(last) };
+struct Fields256 { __EVI_FIELDS_256(m) };
+struct Fields257 { __EVI_FIELDS_256(m) __EVI_FIELDS_1(last) };
+
+struct CArrayMember { int a[3]; int b; };
+struct MixedTypes   { std::uint16_t a; std::int16_t b; };
+struct Point        { int x, y; };
+struct NestedStruct { Point a; int b; };
+struct PointerField { int* a; };
+
+namespace detail = evi::detail;
+
+// -------------------------------------------------------------------------
+// Counting the amount of members.
+static_assert(detail::count_member_fields<Fields1>()   == 1);
+static_assert(detail::count_member_fields<Fields32>()  == 32);
+static_assert(detail::count_member_fields<Fields33>()  == 33);
+static_assert(detail::count_member_fields<Fields256>() == 256);
+static_assert(detail::count_member_fields<Fields257>() == EVI_MAX_STRUCT_FIELDS + 1);
+
+// C arrays are brace elided, so every element is counted.
+static_assert(detail::count_member_fields<CArrayMember>() == 4);
+
+// -------------------------------------------------------------------------
+// Validating structs.
+static_assert(detail::validate_possible_structs<Fields1>());
+static_assert(detail::validate_possible_structs<Fields33>());
+static_assert(detail::validate_possible_structs<Fields256>());
+static_assert(detail::validate_possible_structs<CArrayMember>());
+static_assert(!detail::validate_possible_structs<MixedTypes>());
+static_assert(!detail::validate_possible_structs<NestedStruct>());
+static_assert(!detail::validate_possible_structs<PointerField>());
+
+// -------------------------------------------------------------------------
+// Validating arrays by their element type.
+static_assert(detail::validate_possible_structs<std::array<int, 2>>());
+static_assert(detail::validate_possible_structs<std::array<std::array<int, 2>, 2>>());
+static_assert(detail::validate_possible_structs<std::uint8_t[4]>());
+static_assert(!detail::validate_possible_structs<std::array<Point, 2>>());
+static_assert(!detail::validate_possible_structs<std::array<int*, 2>>());
+static_assert(!detail::validate_possible_structs<std::array<std::array<Point, 1>, 2>>());
+
+// -------------------------------------------------------------------------
+// Instantiating unions with the big structs.
+using Union256 = evi::SafeEndianUnion<evi::ByteOrder::Big, 
+	evi::Union<std::array<std::uint32_t, 256>, Fields256>>;
+using UnionCArray = evi::SafeEndianUnion<evi::ByteOrder::Little, 
+	evi::Union<std::array<int, 4>, CArrayMember>>;
+
+static_assert(sizeof(Union256) > 0);
+static_assert(sizeof(UnionCArray) > 0);
+
+// -------------------------------------------------------------------------
+// Must fail with "Your struct has too many fields".
+#ifdef EVI_CHECK_TOO_MANY_FIELDS
+static_assert(detail::validate_possible_structs<Fields257>());
+#endif